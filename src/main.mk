@@ -52,7 +52,9 @@ SOURCES      := AS_global.C \
                 \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
+                stores/ovStoreCursor.C \
                 stores/ovStoreFile.C \
+                stores/ovStoreView.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -125,10 +127,12 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 stores/ovStoreIndexer.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
+                stores/ovStoreCheck.mk \
                 stores/tgStoreDump.mk \
                 stores/tgStoreLoad.mk \
                 stores/tgStoreFilter.mk \
                 stores/tgStoreCoverageStat.mk \
+                stores/tgStoreCheck.mk \
                 stores/tgTigDisplay.mk \
                 \
                 meryl/libleaff.mk \
@@ -144,6 +148,7 @@ SUBMAKEFILES := stores/gatekeeperCreate.mk \
                 overlapInCore/overlapPair.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
+                overlapInCore/liboverlap/prefixEditDistance-benchmark.mk \
                 \
                 mhap/mhap.mk \
                 mhap/mhapConvert.mk \
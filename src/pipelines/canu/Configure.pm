@@ -343,8 +343,11 @@ sub getAllowedResources ($$$$) {
     if    ($alg eq "bat")      {  $nam = "bogart (unitigger)"; }
     elsif ($alg eq "cns")      {  $nam = "utgcns (consensus"; }
     elsif ($alg eq "cor")      {  $nam = "falcon_sense (read correction)"; }
+    elsif ($alg eq "score")    {  $nam = "filterCorrectionOverlaps (correction overlap scoring)"; }
+    elsif ($alg eq "layout")   {  $nam = "generateCorrectionLayouts (correction layouts)"; }
     elsif ($alg eq "meryl")    {  $nam = "meryl (k-mer counting)"; }
     elsif ($alg eq "oea")      {  $nam = "overlap error adjustment"; }
+    elsif ($alg eq "obt")      {  $nam = "overlap based trimming"; }
     elsif ($alg eq "ovb")      {  $nam = "overlap store parallel bucketizer"; }
     elsif ($alg eq "ovs")      {  $nam = "overlap store parallel sorting"; }
     elsif ($alg eq "red")      {  $nam = "read error detection (overlap error adjustment)"; }
@@ -561,6 +564,22 @@ sub configureAssembler () {
         setGlobalIfUndef("corPartitions", "512");      setGlobalIfUndef("corPartitionMin", "25000");
     }
 
+    #  Scoring overlaps for correction, and building layouts when they're built all at once or
+    #  estimating corrected lengths, run on the master host.
+
+    if      (getGlobal("genomeSize") < adjustGenomeSize("40m")) {
+        setGlobalIfUndef("corScoreMemory",  "2-4");     setGlobalIfUndef("corScoreThreads",  "1-4");
+        setGlobalIfUndef("corLayoutMemory", "2-4");     setGlobalIfUndef("corLayoutThreads", "1-4");
+
+    } elsif (getGlobal("genomeSize") < adjustGenomeSize("1g")) {
+        setGlobalIfUndef("corScoreMemory",  "4-8");     setGlobalIfUndef("corScoreThreads",  "1-8");
+        setGlobalIfUndef("corLayoutMemory", "4-8");     setGlobalIfUndef("corLayoutThreads", "1-8");
+
+    } else {
+        setGlobalIfUndef("corScoreMemory",  "4-16");    setGlobalIfUndef("corScoreThreads",  "1-16");
+        setGlobalIfUndef("corLayoutMemory", "4-16");    setGlobalIfUndef("corLayoutThreads", "1-16");
+    }
+
     #  Meryl too, basically just small or big.  This should really be using the number of bases
     #  reported from gatekeeper.
 
@@ -585,23 +604,35 @@ sub configureAssembler () {
 
     if      (getGlobal("genomeSize") < adjustGenomeSize("40m")) {
         setGlobalIfUndef("redMemory",   "2-8");    setGlobalIfUndef("redThreads",   "1-4");
-        setGlobalIfUndef("oeaMemory",   "2");      setGlobalIfUndef("oeaThreads",   "1");
+        setGlobalIfUndef("oeaMemory",   "2");      setGlobalIfUndef("oeaThreads",   "1-4");
 
     } elsif (getGlobal("genomeSize") < adjustGenomeSize("500m")) {
         setGlobalIfUndef("redMemory",   "4-12");    setGlobalIfUndef("redThreads",   "1-6");
-        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1");
+        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1-6");
 
     } elsif (getGlobal("genomeSize") < adjustGenomeSize("2g")) {
         setGlobalIfUndef("redMemory",   "4-16");    setGlobalIfUndef("redThreads",   "1-8");
-        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1");
+        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1-8");
 
     } elsif (getGlobal("genomeSize") < adjustGenomeSize("5g")) {
         setGlobalIfUndef("redMemory",   "4-32");    setGlobalIfUndef("redThreads",   "1-8");
-        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1");
+        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1-8");
 
     } else {
         setGlobalIfUndef("redMemory",   "4-32");    setGlobalIfUndef("redThreads",   "1-8");
-        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1");
+        setGlobalIfUndef("oeaMemory",   "2");       setGlobalIfUndef("oeaThreads",   "1-8");
+    }
+
+    #  Overlap based trimming, run on the master host.
+
+    if      (getGlobal("genomeSize") < adjustGenomeSize("40m")) {
+        setGlobalIfUndef("obtMemory",   "2-4");     setGlobalIfUndef("obtThreads",   "1-4");
+
+    } elsif (getGlobal("genomeSize") < adjustGenomeSize("500m")) {
+        setGlobalIfUndef("obtMemory",   "2-8");     setGlobalIfUndef("obtThreads",   "1-8");
+
+    } else {
+        setGlobalIfUndef("obtMemory",   "4-16");    setGlobalIfUndef("obtThreads",   "1-16");
     }
 
     #  And bogart.
@@ -633,6 +664,7 @@ sub configureAssembler () {
     ($err, $all) = getAllowedResources("utg", "mhap",     $err, $all);
     ($err, $all) = getAllowedResources("",    "red",      $err, $all);
     ($err, $all) = getAllowedResources("",    "oea",      $err, $all);
+    ($err, $all) = getAllowedResources("",    "obt",      $err, $all);
     ($err, $all) = getAllowedResources("",    "cns",      $err, $all);
     ($err, $all) = getAllowedResources("",    "ovb",      $err, $all);
     ($err, $all) = getAllowedResources("cor", "ovl",      $err, $all);
@@ -640,6 +672,8 @@ sub configureAssembler () {
     ($err, $all) = getAllowedResources("utg", "ovl",      $err, $all);
     ($err, $all) = getAllowedResources("",    "meryl",    $err, $all);
     ($err, $all) = getAllowedResources("",    "cor",      $err, $all);
+    ($err, $all) = getAllowedResources("cor", "score",    $err, $all);
+    ($err, $all) = getAllowedResources("cor", "layout",   $err, $all);
     ($err, $all) = getAllowedResources("cor", "mmap",     $err, $all);
     ($err, $all) = getAllowedResources("obt", "mmap",     $err, $all);
     ($err, $all) = getAllowedResources("utg", "mmap",     $err, $all);
@@ -176,6 +176,7 @@ sub buildCorrectionLayouts_direct ($$) {
         $cmd .= "  -E " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
         $cmd .= "  -C $maxCov \\\n"                                    if (defined($maxCov));
         $cmd .= "  -legacy \\\n"                                       if (!defined(getGlobal("corNoLegacyFilter")));
+        $cmd .= "  -t " . getGlobal("corLayoutThreads") . " \\\n";
         $cmd .= "> $wrk/$asm.corStore.err 2>&1";
 
         if (runCommand($wrk, $cmd)) {
@@ -498,6 +499,7 @@ sub expensiveFilter ($$) {
         $cmd .= "  -E " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
         $cmd .= "  -C $maxCov \\\n"                                    if (defined($maxCov));
         $cmd .= "  -legacy \\\n"                                       if (!defined(getGlobal("corNoLegacyFilter")));
+        $cmd .= "  -t " . getGlobal("corLayoutThreads") . " \\\n";
         $cmd .= "  -p $path/$asm.estimate";
 
         if (runCommand($wrk, $cmd)) {
@@ -744,6 +746,7 @@ sub buildCorrectionLayouts ($$) {
         $cmd .= "  -l $minLen \\\n";
         $cmd .= "  -e " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
         $cmd .= "  -legacy \\\n"                       if (!defined(getGlobal("corNoLegacyFilter")));
+        $cmd .= "  -t " . getGlobal("corScoreThreads") . " \\\n";
         $cmd .= "> $path/$asm.globalScores.err 2>&1";
 
         if (runCommand($path, $cmd)) {
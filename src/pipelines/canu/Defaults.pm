@@ -797,6 +797,9 @@ sub setDefaults () {
 
     setExecDefaults("cor",    "read correction");
 
+    setExecDefaults("corscore",  "overlap scoring for correction");
+    setExecDefaults("corlayout", "layouts for correction");
+
     setExecDefaults("corovl",  "overlaps for correction");
     setExecDefaults("obtovl",  "overlaps for trimming");
     setExecDefaults("utgovl",  "overlaps for unitig construction");
@@ -815,6 +818,8 @@ sub setDefaults () {
     setExecDefaults("red",    "read error detection");
     setExecDefaults("oea",    "overlap error adjustment");
 
+    setExecDefaults("obt",    "overlap based trimming");
+
     setExecDefaults("bat",    "unitig construction");
     setExecDefaults("cns",    "unitig consensus");
 
@@ -454,6 +454,7 @@ sub overlapErrorAdjustmentConfigure ($$) {
     print F "    -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "    -c $path/red.red \\\n";
     print F "    -o $path/\$jobid.oea.WORKING \\\n";
+    print F "    -t " . getGlobal("oeaThreads") . " \\\n";
     print F "  && \\\n";
     print F "  mv $path/\$jobid.oea.WORKING $path/\$jobid.oea\n";
     print F "fi\n";